@@ -371,6 +371,12 @@ query_processor::query_processor(service::storage_proxy& proxy, data_dictionary:
                             _cql_stats.secondary_index_rows_read,
                             sm::description("Counts the total number of rows read during CQL requests performed using secondary indexes.")).set_skip_when_empty(),
 
+                    // secondary_index_index_only_reads count is also included in secondary_index_reads
+                    sm::make_counter(
+                            "secondary_index_index_only_reads",
+                            _cql_stats.secondary_index_index_only_reads,
+                            sm::description("Counts the total number of CQL read requests using secondary indexes which were answered from the index alone, without reading the base table.")).set_skip_when_empty(),
+
                     // read requests that required ALLOW FILTERING
                     sm::make_counter(
                             "filtered_read_requests",
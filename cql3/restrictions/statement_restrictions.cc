@@ -951,6 +951,29 @@ static std::vector<expr::expression> extract_partition_range(
     return {};
 }
 
+/// Returns the right-hand sides of \p partition_range_restrictions, in partition key order, if they consist of exactly
+/// one `col = value` per partition column.  Otherwise, returns an empty vector.
+static std::vector<expr::expression> extract_partition_key_eq_values(
+        const std::vector<expr::expression>& partition_range_restrictions, const schema& schema) {
+    if (partition_range_restrictions.size() != schema.partition_key_size()) {
+        return {};
+    }
+    std::vector<std::optional<expr::expression>> values(schema.partition_key_size());
+    for (const auto& e : partition_range_restrictions) {
+        auto binop = expr::as_if<binary_operator>(&e);
+        if (!binop || binop->op != oper_t::EQ) {
+            return {};
+        }
+        auto cv = expr::as_if<column_value>(&binop->lhs);
+        if (!cv || !cv->col->is_partition_key() || values[schema.position(*cv->col)]) {
+            return {};
+        }
+        values[schema.position(*cv->col)] = binop->rhs;
+    }
+    return values | std::views::transform([] (std::optional<expr::expression>& v) { return std::move(*v); })
+            | std::ranges::to<std::vector>();
+}
+
 /// Extracts where_clause atoms with clustering-column LHS and copies them to a vector.  These elements define the
 /// boundaries of any clustering slice that can possibly meet where_clause.  This vector can be calculated before
 /// binding expression markers, since LHS and operator are always known.
@@ -1129,6 +1152,7 @@ statement_restrictions::statement_restrictions(data_dictionary::database db,
         _single_column_nonprimary_key_restrictions = get_single_column_restrictions_map(_nonprimary_key_restrictions);
         _clustering_prefix_restrictions = extract_clustering_prefix_restrictions(*_where, _schema);
         _partition_range_restrictions = extract_partition_range(*_where, _schema);
+        _partition_key_eq_values = extract_partition_key_eq_values(_partition_range_restrictions, *_schema);
     }
     _has_multi_column = find_binop(_clustering_columns_restrictions, is_multi_column);
     if (_check_indexes) {
@@ -1948,6 +1972,19 @@ dht::partition_range_vector partition_ranges_from_EQs(
 } // anonymous namespace
 
 dht::partition_range_vector statement_restrictions::get_partition_key_ranges(const query_options& options) const {
+    if (!_partition_key_eq_values.empty()) {
+        // Fast path for point lookups, equivalent to partition_ranges_from_EQs().
+        std::vector<managed_bytes> pk_value;
+        pk_value.reserve(_partition_key_eq_values.size());
+        for (const auto& rhs : _partition_key_eq_values) {
+            managed_bytes_opt val = expr::evaluate(rhs, options).to_managed_bytes_opt();
+            if (!val) {
+                return {}; // All NULL comparisons fail; no partition matches.
+            }
+            pk_value.push_back(std::move(*val));
+        }
+        return {range_from_bytes(*_schema, pk_value)};
+    }
     if (_partition_range_restrictions.empty()) {
         return {dht::partition_range::make_open_ended_both_sides()};
     }
@@ -117,6 +117,11 @@ class statement_restrictions {
 
     bool _partition_range_is_simple; ///< False iff _partition_range_restrictions imply a Cartesian product.
 
+    /// When every partition column is restricted by a single `col = value`, the values, in partition key order.
+    /// Lets get_partition_key_ranges() bind them directly, without solving the restrictions on every execution.
+    /// Empty otherwise.
+    std::vector<expr::expression> _partition_key_eq_values;
+
 
     check_indexes _check_indexes = check_indexes::yes;
     std::vector<const column_definition*> _column_defs_for_filtering;
@@ -26,8 +26,13 @@ class result_generator {
     template<typename Visitor>
     class query_result_visitor {
         const schema& _schema;
-        std::vector<bytes> _partition_key;
-        std::vector<bytes> _clustering_key;
+        // Views into the keys passed to accept_new_partition() and
+        // accept_new_row(). query::result_view::consume() keeps the
+        // partition key alive until accept_partition_end() returns and the
+        // clustering key until accept_new_row() returns, which is as long
+        // as they are used here, so the key components need not be copied.
+        std::vector<managed_bytes_view> _partition_key;
+        std::vector<managed_bytes_view> _clustering_key;
         uint64_t _partition_row_count = 0;
         uint64_t _total_row_count = 0;
         Visitor& _visitor;
@@ -41,12 +46,19 @@ class result_generator {
                 _visitor.accept_value(cell ? utils::buffer_view_to_managed_bytes_view(cell->value()) : managed_bytes_view_opt());
             }
         }
+
+        void explode_into(std::vector<managed_bytes_view>& components, const auto& key) const {
+            components.clear();
+            for (managed_bytes_view c : key.components(_schema)) {
+                components.push_back(c);
+            }
+        }
     public:
         query_result_visitor(const schema& s, Visitor& visitor, const selection::selection& select)
             : _schema(s), _visitor(visitor), _selection(select) { }
 
         void accept_new_partition(const partition_key& key, uint64_t row_count) {
-            _partition_key = key.explode(_schema);
+            explode_into(_partition_key, key);
             accept_new_partition(row_count);
         }
         void accept_new_partition(uint64_t row_count) {
@@ -56,7 +68,7 @@ class result_generator {
 
         void accept_new_row(const clustering_key& key, query::result_row_view static_row,
                             query::result_row_view row) {
-            _clustering_key = key.explode(_schema);
+            explode_into(_clustering_key, key);
             accept_new_row(static_row, row);
         }
         void accept_new_row(query::result_row_view static_row, query::result_row_view row) {
@@ -66,11 +78,11 @@ class result_generator {
             for (auto&& def : _selection.get_columns()) {
                 switch (def->kind) {
                 case column_kind::partition_key:
-                    _visitor.accept_value(bytes_view(_partition_key[def->component_index()]));
+                    _visitor.accept_value(managed_bytes_view_opt(_partition_key[def->component_index()]));
                     break;
                 case column_kind::clustering_key:
                     if (_clustering_key.size() > def->component_index()) {
-                        _visitor.accept_value(bytes_view(_clustering_key[def->component_index()]));
+                        _visitor.accept_value(managed_bytes_view_opt(_clustering_key[def->component_index()]));
                     } else {
                         _visitor.accept_value(std::nullopt);
                     }
@@ -93,7 +105,7 @@ class result_generator {
                 auto static_row_iterator = static_row.iterator();
                 for (auto&& def : _selection.get_columns()) {
                     if (def->is_partition_key()) {
-                        _visitor.accept_value(bytes_view(_partition_key[def->component_index()]));
+                        _visitor.accept_value(managed_bytes_view_opt(_partition_key[def->component_index()]));
                     } else if (def->is_static()) {
                         accept_cell_value(*def, static_row_iterator);
                     } else {
@@ -146,6 +146,12 @@ void cf_prop_defs::validate(const data_dictionary::database db, sstring ks_name,
         throw exceptions::configuration_exception("Per-partition rate limit is not supported yet by the whole cluster");
     }
 
+    // Older nodes reject unknown caching sub-options when loading the schema.
+    auto caching = get_caching_options();
+    if (caching && caching->max_rows_populated_per_read() && !db.features().caching_max_rows_populated_per_read) {
+        throw exceptions::configuration_exception(format("Caching option {} is not supported yet by the whole cluster", caching_options::max_rows_populated_per_read_key));
+    }
+
     auto tombstone_gc_options = get_tombstone_gc_options(schema_extensions);
     validate_tombstone_gc_options(tombstone_gc_options, db, ks_name);
 
@@ -21,6 +21,7 @@
 #include "exceptions/exceptions.hh"
 #include <seastar/core/future.hh>
 #include <seastar/coroutine/exception.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include "service/broadcast_tables/experimental/lang.hh"
 #include "service/qos/qos_common.hh"
 #include "service/vector_store_client.hh"
@@ -49,6 +50,8 @@
 #include "cql3/untyped_result_set.hh"
 #include "db/timeout_clock.hh"
 #include "db/consistency_level_validations.hh"
+#include "db/tags/extension.hh"
+#include "db/tags/utils.hh"
 #include "data_dictionary/data_dictionary.hh"
 #include "test/lib/select_statement_utils.hh"
 #include "gms/feature_service.hh"
@@ -1088,6 +1091,30 @@ indexed_table_select_statement::indexed_table_select_statement(schema_ptr schema
         _get_partition_ranges_for_posting_list = [this] (const query_options& options) { return get_partition_ranges_for_global_index_posting_list(options); };
         _get_partition_slice_for_posting_list = [this] (const query_options& options) { return get_partition_slice_for_global_index_posting_list(options); };
     }
+    _index_only = can_answer_from_index_alone();
+}
+
+bool indexed_table_select_statement::can_answer_from_index_alone() const {
+    if (_prepared_ann_ordering || _restrictions_need_filtering || _per_partition_limit || _is_reversed) {
+        return false;
+    }
+    if (!_selection->is_trivial() || _selection->is_aggregate() || has_group_by()) {
+        return false;
+    }
+    // Every row of an index on a regular column maps to exactly one base
+    // row, and the index view's primary key holds the base primary key.
+    // Indexes on key, static or collection columns map index rows to whole
+    // partitions or slices of them, so they still need the base read.
+    if (_index.target_type() != cql3::statements::index_target::target_type::regular_values) {
+        return false;
+    }
+    const column_definition* target_cdef = _schema->get_column_definition(to_bytes(_index.target_column()));
+    if (!target_cdef || !target_cdef->is_regular()) {
+        return false;
+    }
+    return std::ranges::all_of(_selection->get_columns(), [] (const column_definition* cdef) {
+        return cdef->is_primary_key();
+    });
 }
 
 template<typename KeyType>
@@ -1328,6 +1355,10 @@ indexed_table_select_statement::do_execute(query_processor& qp,
         co_return shared_ptr<cql_transport::messages::result_message>(std::move(msg));
     }
 
+    if (_index_only && !needs_post_query_ordering() && index_updated_synchronously(qp)) {
+        co_return co_await execute_index_only_query(qp, state, options, now);
+    }
+
     if (whole_partitions || partition_slices) {
         tracing::trace(state.get_trace_state(), "Consulting index {} for a single slice of keys", _index.metadata().name());
         // In this case, can use our normal query machinery, which retrieves
@@ -1355,6 +1386,61 @@ indexed_table_select_statement::do_execute(query_processor& qp,
     }
 }
 
+// Updates of an index view are asynchronous (and hinted when a view replica is
+// down) unless the view has the synchronous_updates tag, which local indexes
+// always have. An asynchronous index may still hold rows whose base row was
+// already deleted, and it's the base read that drops them, so only queries
+// using a synchronous index may skip it. The tag can be changed with ALTER
+// MATERIALIZED VIEW, which doesn't invalidate statements on the base table,
+// so the current view schema is consulted.
+bool indexed_table_select_statement::index_updated_synchronously(query_processor& qp) const {
+    auto view = qp.db().find_schema(_view_schema->id());
+    auto tag = db::find_tag(*view, db::SYNCHRONOUS_VIEW_UPDATES_TAG_KEY);
+    return tag && *tag == "true";
+}
+
+// Answers a query which selects only base primary key columns straight from
+// the rows of the index view, skipping the second read of each matching row
+// from the base table. The paging state of the index read is already
+// expressed in terms of the view, so it is handed to the client as is.
+future<shared_ptr<cql_transport::messages::result_message>>
+indexed_table_select_statement::execute_index_only_query(query_processor& qp,
+        service::query_state& state,
+        const query_options& options,
+        gc_clock::time_point now) const {
+    tracing::trace(state.get_trace_state(), "Consulting index {} for a list of rows, answering from the index alone", _index.metadata().name());
+    ++_stats.secondary_index_index_only_reads;
+    auto keys_result = co_await find_index_clustering_rows(qp, state, options);
+    if (keys_result.has_error()) {
+        co_return failed_result_to_result_message(std::move(keys_result));
+    }
+    auto&& [primary_keys, paging_state] = keys_result.assume_value();
+
+    cql3::selection::result_set_builder builder(*_selection, now, &options);
+    for (const auto& key : primary_keys) {
+        auto exploded_pk = key.partition.key().explode(*_schema);
+        auto exploded_ck = key.clustering.explode(*_schema);
+        builder.start_new_row();
+        for (const column_definition* cdef : _selection->get_columns()) {
+            if (cdef->is_partition_key()) {
+                builder.add(std::move(exploded_pk[cdef->component_index()]));
+            } else if (cdef->component_index() < exploded_ck.size()) {
+                builder.add(std::move(exploded_ck[cdef->component_index()]));
+            } else {
+                builder.add({});
+            }
+        }
+        builder.complete_row();
+        co_await coroutine::maybe_yield();
+    }
+    auto rs = builder.build();
+    if (paging_state) {
+        rs->get_metadata().set_paging_state(std::move(paging_state));
+    }
+    update_stats_rows_read(rs->size());
+    co_return ::make_shared<cql_transport::messages::result_message::rows>(result(std::move(rs)));
+}
+
 dht::partition_range_vector indexed_table_select_statement::get_partition_ranges_for_local_index_posting_list(const query_options& options) const {
     return _restrictions->get_partition_key_ranges(options);
 }
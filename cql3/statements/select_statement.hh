@@ -191,6 +191,11 @@ class indexed_table_select_statement : public select_statement {
     std::optional<prepared_ann_ordering_type>  _prepared_ann_ordering;
     noncopyable_function<dht::partition_range_vector(const query_options&)> _get_partition_ranges_for_posting_list;
     noncopyable_function<query::partition_slice(const query_options&)> _get_partition_slice_for_posting_list;
+    // True if all the columns the query needs are part of the index view's
+    // primary key, so the query can be answered from the index alone,
+    // without reading the base table, provided the index is updated
+    // synchronously (see index_updated_synchronously()).
+    bool _index_only;
 public:
     static constexpr size_t max_base_table_query_concurrency = 4096;
     static constexpr size_t max_ann_query_limit = 1000;
@@ -232,6 +237,12 @@ class indexed_table_select_statement : public select_statement {
     virtual future<::shared_ptr<cql_transport::messages::result_message>> do_execute(query_processor& qp,
             service::query_state& state, const query_options& options) const override;
 
+    bool can_answer_from_index_alone() const;
+    bool index_updated_synchronously(query_processor& qp) const;
+
+    future<shared_ptr<cql_transport::messages::result_message>> execute_index_only_query(query_processor& qp,
+            service::query_state& state, const query_options& options, gc_clock::time_point now) const;
+
     lw_shared_ptr<const service::pager::paging_state> generate_view_paging_state_from_base_query_results(lw_shared_ptr<const service::pager::paging_state> paging_state,
             const foreign_ptr<lw_shared_ptr<query::result>>& results, service::query_state& state, const query_options& options) const;
 
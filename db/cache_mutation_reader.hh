@@ -117,6 +117,10 @@ class cache_mutation_reader final : public mutation_reader::impl {
     // Valid when _state == reading_from_underlying.
     bool _population_range_starts_before_all_rows;
 
+    // Number of clustering rows this reader may still insert into the cache,
+    // see caching_options::max_rows_populated_per_read().
+    uint64_t _rows_to_populate;
+
     // Points to the underlying reader conforming to _schema,
     // either to *_underlying_holder or _read_context.underlying().underlying().
     mutation_reader* _underlying = nullptr;
@@ -145,6 +149,8 @@ class cache_mutation_reader final : public mutation_reader::impl {
     void start_reading_from_underlying();
     bool after_current_range(position_in_partition_view position);
     bool can_populate() const;
+    // Accounts for an insertion skipped because !can_populate().
+    void on_not_populated();
     // Marks the range between _last_row (exclusive) and _next_row (exclusive) as continuous,
     // provided that the underlying reader still matches the latest version of the partition.
     // Invalidates _last_row.
@@ -242,6 +248,7 @@ class cache_mutation_reader final : public mutation_reader::impl {
         , _read_context_holder()
         , _read_context(ctx)    // ctx is owned by the caller, who's responsible for closing it.
         , _next_row(*_schema, *_snp, false, _read_context.is_reversed())
+        , _rows_to_populate(_schema->caching_options().max_rows_populated_per_read().value_or(std::numeric_limits<uint64_t>::max()))
         , _read_time(get_read_time())
     {
         clogger.trace("csm {}: table={}.{}, dk={}, reversed={}, snap={}",
@@ -517,7 +524,7 @@ future<> cache_mutation_reader::read_from_underlying() {
                             });
                         }
                     } else {
-                        _read_context.cache().on_mispopulate();
+                        on_not_populated();
                     }
                     try {
                         move_to_next_range();
@@ -635,7 +642,7 @@ void cache_mutation_reader::maybe_update_continuity() {
             maybe_drop_last_entry(_current_tombstone);
         });
     } else {
-        _read_context.cache().on_mispopulate();
+        on_not_populated();
     }
 }
 
@@ -644,7 +651,7 @@ void cache_mutation_reader::maybe_add_to_cache(const clustering_row& cr) {
     if (!can_populate()) {
         _last_row = nullptr;
         _population_range_starts_before_all_rows = false;
-        _read_context.cache().on_mispopulate();
+        on_not_populated();
         return;
     }
     clogger.trace("csm {}: populate({}), rt={}", fmt::ptr(this), clustering_row::printer(*_schema, cr), _current_tombstone);
@@ -666,6 +673,7 @@ void cache_mutation_reader::maybe_add_to_cache(const clustering_row& cr) {
         if (insert_result.second) {
             _snp->tracker()->insert(*it);
             restore_continuity_after_insertion(it);
+            --_rows_to_populate;
         }
 
         rows_entry& e = *it;
@@ -714,7 +722,7 @@ bool cache_mutation_reader::maybe_add_to_cache(const range_tombstone_change& rtc
         // _current_tombstone is now invalid and remains so for this reader. No need to change it.
         _last_row = nullptr;
         _population_range_starts_before_all_rows = false;
-        _read_context.cache().on_mispopulate();
+        on_not_populated();
         return true;
     }
 
@@ -939,7 +947,7 @@ void cache_mutation_reader::move_to_range(query::clustering_row_ranges::const_it
                 }
                 _last_row = partition_snapshot_row_weakref(*_snp, it, true);
             } else {
-                _read_context.cache().on_mispopulate();
+                on_not_populated();
             }
         }
         start_reading_from_underlying();
@@ -1077,7 +1085,7 @@ void cache_mutation_reader::maybe_add_to_cache(const static_row& sr) {
             _snp->version()->partition().static_row().apply(table_schema(), column_kind::static_column, sr.cells());
         });
     } else {
-        _read_context.cache().on_mispopulate();
+        on_not_populated();
     }
 }
 
@@ -1087,7 +1095,7 @@ void cache_mutation_reader::maybe_set_static_row_continuous() {
         clogger.trace("csm {}: set static row continuous", fmt::ptr(this));
         _snp->version()->partition().set_static_row_continuous(true);
     } else {
-        _read_context.cache().on_mispopulate();
+        on_not_populated();
     }
 }
 
@@ -1113,9 +1121,18 @@ void cache_mutation_reader::restore_continuity_after_insertion(const mutation_pa
     }
 }
 
+inline
+void cache_mutation_reader::on_not_populated() {
+    if (_rows_to_populate == 0) {
+        _read_context.cache().on_population_over_limit();
+    } else {
+        _read_context.cache().on_mispopulate();
+    }
+}
+
 inline
 bool cache_mutation_reader::can_populate() const {
-    return _snp->at_latest_version() && _read_context.cache().phase_of(_read_context.key()) == _read_context.phase();
+    return _rows_to_populate > 0 && _snp->at_latest_version() && _read_context.cache().phase_of(_read_context.key()) == _read_context.phase();
 }
 
 } // namespace cache
@@ -62,6 +62,7 @@ class cache_tracker final {
         uint64_t partitions;
         uint64_t rows;
         uint64_t mispopulations;
+        uint64_t populations_over_limit;
         uint64_t underlying_recreations;
         uint64_t underlying_partition_skips;
         uint64_t underlying_row_skips;
@@ -119,6 +120,7 @@ class cache_tracker final {
     void on_row_miss() noexcept;
     void on_miss_already_populated() noexcept;
     void on_mispopulate() noexcept;
+    void on_population_over_limit() noexcept { ++_stats.populations_over_limit; }
     void on_row_processed_from_memtable() noexcept { ++_stats.rows_processed_from_memtable; }
     void on_row_dropped_from_memtable() noexcept { ++_stats.rows_dropped_from_memtable; }
     void on_row_merged_from_memtable() noexcept { ++_stats.rows_merged_from_memtable; }
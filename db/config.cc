@@ -1081,6 +1081,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Enable or disable keepalive on client connections (CQL native and the maintenance socket).")
     , cache_hit_rate_read_balancing(this, "cache_hit_rate_read_balancing", value_status::Used, true,
         "This boolean controls whether the replicas for read query will be chosen based on cache hit ratio.")
+    , speculative_retry_budget(this, "speculative_retry_budget", liveness::LiveUpdate, value_status::Used, 0,
+        "Limits speculative read retries (see the speculative_retry table option) to this fraction of the reads which may speculate, per shard. For example, 0.1 allows at most one speculative retry per 10 reads, so that a slow replica cannot double the read load on the others. Tables with speculative_retry = 'ALWAYS' are not limited. Must be in [0, 1]; 0 means no limit. An invalid value is rejected at startup; if it is set by a live update, it is logged and ignored, and the last valid value stays in effect.")
     /**
     * @Group Advanced fault detection settings
     * @GroupDescription Settings to handle poorly performing or failing nodes.
@@ -358,6 +358,7 @@ class config final : public utils::config_file {
     named_value<bool> start_rpc;
     named_value<bool> rpc_keepalive;
     named_value<bool> cache_hit_rate_read_balancing;
+    named_value<double> speculative_retry_budget;
     named_value<double> dynamic_snitch_badness_threshold;
     named_value<uint32_t> dynamic_snitch_reset_interval_in_ms;
     named_value<uint32_t> dynamic_snitch_update_interval_in_ms;
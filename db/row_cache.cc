@@ -165,6 +165,7 @@ cache_tracker::setup_metrics() {
         sm::make_counter("partition_evictions", sm::description("total number of evicted partitions"), _stats.partition_evictions)(basic_level),
         sm::make_counter("partition_removals", sm::description("total number of invalidated partitions"), _stats.partition_removals)(basic_level),
         sm::make_counter("mispopulations", sm::description("number of entries not inserted by reads"), _stats.mispopulations),
+        sm::make_counter("populations_over_limit", sm::description("number of entries not inserted by reads because the table's max_rows_populated_per_read was reached"), _stats.populations_over_limit),
         sm::make_gauge("partitions", sm::description("total number of cached partitions"), _stats.partitions),
         sm::make_gauge("rows", sm::description("total number of cached rows"), _stats.rows),
         sm::make_counter("reads", sm::description("number of started reads"), _stats.reads)(basic_level),
@@ -512,6 +513,10 @@ void row_cache::on_mispopulate() {
     _tracker.on_mispopulate();
 }
 
+void row_cache::on_population_over_limit() {
+    _tracker.on_population_over_limit();
+}
+
 void row_cache::on_row_miss() {
     _stats.misses.mark();
     _tracker.on_row_miss();
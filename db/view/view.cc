@@ -2040,18 +2040,22 @@ future<> view_update_generator::mutate_MV(
     // TODO: Maybe allow users to set use_legacy_self_pairing explicitly
     // on a view, like we have the synchronous_updates_flag.
     bool use_legacy_self_pairing = !ks.uses_tablets();
-    std::unordered_map<table_id, locator::effective_replication_map_ptr> erms;
-    auto get_erm = [&] (table_id id) {
-        auto it = erms.find(id);
-        if (it == erms.end()) {
-            it = erms.emplace(id, _db.find_column_family(id).get_effective_replication_map()).first;
-        }
-        return it->second;
+    // The replication map of each view is resolved once per batch. Cache the
+    // synchronous_updates tag of the view alongside it, instead of looking it
+    // up in the view's schema extensions for every update.
+    struct view_target_state {
+        locator::effective_replication_map_ptr erm;
+        bool update_synchronously = false;
     };
-    auto base_ermp = get_erm(base->id());
+    std::unordered_map<table_id, view_target_state> view_states;
     for (const auto& mut : view_updates) {
-        (void)get_erm(mut.s->id());
+        auto [it, inserted] = view_states.try_emplace(mut.s->id());
+        if (inserted) {
+            it->second.erm = _db.find_column_family(mut.s->id()).get_effective_replication_map();
+            it->second.update_synchronously = should_update_synchronously(*mut.s);
+        }
     }
+    auto base_ermp = _db.find_column_family(base->id()).get_effective_replication_map();
     // Enable rack-aware view updates pairing for tablets
     // when the cluster feature is enabled so that all replicas agree
     // on the pairing algorithm.
@@ -2061,13 +2065,14 @@ future<> view_update_generator::mutate_MV(
     co_await utils::get_local_injector().inject("delay_before_get_view_natural_endpoint", 8000ms);
     co_await max_concurrent_for_each(view_updates, max_concurrent_updates, [&] (frozen_mutation_and_schema mut) mutable -> future<> {
         auto view_token = dht::get_token(*mut.s, mut.fm.key());
-        auto view_ermp = erms.at(mut.s->id());
+        const auto& view_state = view_states.at(mut.s->id());
+        auto view_ermp = view_state.erm;
         auto target_endpoint = get_view_natural_endpoint(me, base_ermp, view_ermp, replication, base_token, view_token,
                 use_legacy_self_pairing, use_tablets_rack_aware_view_pairing, cf_stats);
         auto remote_endpoints = view_ermp->get_pending_replicas(view_token);
         auto sem_units = seastar::make_lw_shared<db::timeout_semaphore_units>(pending_view_updates.split(memory_usage_of(mut)));
 
-        const bool update_synchronously = should_update_synchronously(*mut.s);
+        const bool update_synchronously = view_state.update_synchronously;
         if (update_synchronously) {
             tracing::trace(tr_state, "Forcing {}.{} view update to be synchronous (synchronous_updates property was set)",
                 mut.s->ks_name(), mut.s->cf_name()
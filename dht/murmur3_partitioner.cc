@@ -44,6 +44,16 @@ murmur3_partitioner::get_token(const sstables::key_view& key) const {
 
 token
 murmur3_partitioner::get_token(const schema& s, partition_key_view key) const {
+    // The legacy form of a single-component key is the component itself,
+    // so hash it in place instead of going through the byte-at-a-time
+    // legacy_compound_view iterator.
+    const auto& type = *s.partition_key_type();
+    if (type.is_singular()) {
+        auto component = *type.begin(key.representation());
+        if (component.current_fragment().size() == component.size()) {
+            return get_token(component.current_fragment());
+        }
+    }
     std::array<uint64_t, 2> hash;
     auto&& legacy = key.legacy_form(s);
     utils::murmur_hash::hash3_x64_128(legacy.begin(), legacy.size(), 0, hash);
@@ -169,6 +169,7 @@ class feature_service final : public peering_sharded_service<feature_service> {
     gms::feature topology_global_request_queue { *this, "TOPOLOGY_GLOBAL_REQUEST_QUEUE"sv };
     gms::feature lwt_with_tablets { *this, "LWT_WITH_TABLETS"sv };
     gms::feature repair_msg_split { *this, "REPAIR_MSG_SPLIT"sv };
+    gms::feature caching_max_rows_populated_per_read { *this, "CACHING_MAX_ROWS_POPULATED_PER_READ"sv };
 public:
 
     const std::unordered_map<sstring, std::reference_wrapper<feature>>& registered_features() const;
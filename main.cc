@@ -920,6 +920,11 @@ sharded<locator::shared_token_metadata> token_metadata;
                 throw bad_configuration_error();
             }
 
+            if (!(cfg->speculative_retry_budget() >= 0 && cfg->speculative_retry_budget() <= 1)) {
+                startlog.error("Bad configuration: speculative_retry_budget must be in [0, 1], got {}", cfg->speculative_retry_budget());
+                throw bad_configuration_error();
+            }
+
             // We want to ensure a node is zero-token if and only if join_ring=false, so all the logic can rely on it.
             if (cfg->join_ring() && cfg->num_tokens() == 0 && cfg->initial_token().empty()) {
                 startlog.error(
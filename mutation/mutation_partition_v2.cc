@@ -258,6 +258,13 @@ stop_iteration mutation_partition_v2::apply_monotonically(const schema& s, const
     // B-tree nodes.
     auto memory_reserve_for_sentinel_inserts = hold_reserve(logalloc::segment_size);
 
+    // Writes which only append rows past the last existing one (e.g. time-series
+    // ingestion into a memtable) would otherwise pay for a full B-tree descent
+    // in lower_bound() below, which would land on end() anyway.
+    if (p_i != p._rows.end() && i != _rows.end() && cmp(*std::prev(_rows.end()), *p_i) < 0) {
+        i = _rows.end();
+    }
+
     while (p_i != p._rows.end()) {
         rows_entry& src_e = *p_i;
 
@@ -152,9 +152,12 @@ class result_view {
         for (auto&& p : _v.partitions()) {
             auto rows = p.rows();
             auto row_count = rows.size();
+            // The visitor may keep views into the partition key until
+            // accept_partition_end(), so it must outlive the whole partition.
+            std::optional<partition_key> key;
             if (slice.options.contains<partition_slice::option::send_partition_key>()) {
-                auto key = *p.key();
-                visitor.accept_new_partition(key, row_count);
+                key = *p.key();
+                visitor.accept_new_partition(*key, row_count);
             } else {
                 visitor.accept_new_partition(row_count);
             }
@@ -3121,6 +3121,16 @@ class row_level_repair {
                 continue;
             }
 
+            // Fast path: if remote has zero rows, there is nothing to get
+            // from it and no need to fetch its (empty) full row hashes. The
+            // empty peer_row_hash_sets makes Step C send it all the rows
+            // with needs_all_rows_t::yes, without diffing them row by row.
+            if (combined_hashes[node_idx + 1] == repair_hash()) {
+                rlogger.debug("FastPath: node {} has no rows, skip get_full_row_hashes", node);
+                master.peer_row_hash_sets(node_idx).clear();
+                continue;
+            }
+
             rlogger.debug("Before master.get_full_row_hashes for node {}, hash_sets={}",
                 node, master.peer_row_hash_sets(node_idx).size());
             // Ask the peer to send the full list hashes in the working row buf.
@@ -12,8 +12,8 @@
 #include "exceptions/exceptions.hh"
 #include "utils/rjson.hh"
 
-caching_options::caching_options(sstring k, sstring r, bool enabled)
-        : _key_cache(k), _row_cache(r), _enabled(enabled) {
+caching_options::caching_options(sstring k, sstring r, bool enabled, std::optional<uint64_t> max_rows_populated_per_read)
+        : _key_cache(k), _row_cache(r), _max_rows_populated_per_read(max_rows_populated_per_read), _enabled(enabled) {
     if ((k != "ALL") && (k != "NONE")) {
         throw exceptions::configuration_exception("Invalid key value: " + k); 
     }
@@ -40,6 +40,9 @@ caching_options::to_map() const {
     if (!_enabled) {
         res.insert({"enabled", "false"});
     }
+    if (_max_rows_populated_per_read) {
+        res.insert({max_rows_populated_per_read_key, format("{}", *_max_rows_populated_per_read)});
+    }
     return res;
 }
 
@@ -58,6 +61,7 @@ caching_options::from_map(const std::map<sstring, sstring>& map) {
     sstring k = default_key;
     sstring r = default_row;
     bool e = true;
+    std::optional<uint64_t> max_rows;
 
     for (auto& p : map) {
         if (p.first == "keys") {
@@ -66,11 +70,24 @@ caching_options::from_map(const std::map<sstring, sstring>& map) {
             r = p.second;
         } else if (p.first == "enabled") {
             e = p.second == "true";
+        } else if (p.first == max_rows_populated_per_read_key) {
+            int64_t v;
+            try {
+                // Parsed as signed, because lexical_cast wraps "-1" around
+                // when casting to an unsigned type.
+                v = boost::lexical_cast<int64_t>(p.second);
+            } catch (boost::bad_lexical_cast&) {
+                throw exceptions::configuration_exception(format("Invalid {} value: {}", max_rows_populated_per_read_key, p.second));
+            }
+            if (v <= 0) {
+                throw exceptions::configuration_exception(format("{} must be greater than 0", max_rows_populated_per_read_key));
+            }
+            max_rows = v;
         } else {
             throw exceptions::configuration_exception(format("Invalid caching option: {}", p.first));
         }
     }
-    return caching_options(k, r, e);
+    return caching_options(k, r, e, max_rows);
 }
 
 caching_options
@@ -9,6 +9,7 @@
 #pragma once
 #include <seastar/core/sstring.hh>
 #include <map>
+#include <optional>
 #include "seastarx.hh"
 
 class schema;
@@ -24,16 +25,27 @@ class caching_options {
 
     sstring _key_cache;
     sstring _row_cache;
+    std::optional<uint64_t> _max_rows_populated_per_read;
     bool _enabled = true;
-    caching_options(sstring k, sstring r, bool enabled);
+    caching_options(sstring k, sstring r, bool enabled, std::optional<uint64_t> max_rows_populated_per_read = std::nullopt);
 
     friend class schema;
     caching_options();
 public:
+    static constexpr auto max_rows_populated_per_read_key = "max_rows_populated_per_read";
+
     bool enabled() const {
         return _enabled;
     }
 
+    // The maximum number of clustering rows a single read inserts into the
+    // row cache for a partition, so that a scan of a large partition doesn't
+    // push out the rest of the cache. Unlike Cassandra's rows_per_partition,
+    // this doesn't bound what the cache holds: later reads insert more rows.
+    std::optional<uint64_t> max_rows_populated_per_read() const {
+        return _max_rows_populated_per_read;
+    }
+
     std::map<sstring, sstring> to_map() const;
 
     sstring to_sstring() const;
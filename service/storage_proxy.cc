@@ -2924,6 +2924,10 @@ void storage_proxy_stats::stats::register_stats() {
                        sm::description("number of speculative data read requests that were sent"),
                        {storage_proxy_stats::current_scheduling_group_label(), basic_level}).set_skip_when_empty(),
 
+        sm::make_total_operations("speculative_reads_over_budget", speculative_reads_over_budget,
+                       sm::description("number of speculative read requests that were not sent because speculative_retry_budget was exhausted"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
         sm::make_summary("cas_read_latency_summary", sm::description("CAS read latency summary"), [this] {return to_metrics_summary(cas_read.summary());})(storage_proxy_stats::current_scheduling_group_label())(basic_level)(cas_label).set_skip_when_empty(),
         sm::make_summary("cas_write_latency_summary", sm::description("CAS write latency summary"), [this] {return to_metrics_summary(cas_write.summary());})(storage_proxy_stats::current_scheduling_group_label())(basic_level)(cas_label).set_skip_when_empty(),
 
@@ -5750,8 +5754,14 @@ class speculating_read_executor : public abstract_read_executor {
                                               ", required at least 2 replicas",
                                               _targets.size()));
         }
+        _proxy->add_speculative_retry_budget();
         _speculate_timer.set_callback([this, resolver, timeout] {
             if (!resolver->is_completed()) { // at the time the callback runs request may be completed already
+                if (!_proxy->try_consume_speculative_retry_budget()) {
+                    _proxy->get_stats().speculative_reads_over_budget++;
+                    tracing::trace(_trace_state, "Not launching speculative retry, speculative retry budget exhausted");
+                    return;
+                }
                 resolver->add_wait_targets(1); // we send one more request so wait for it too
                 // FIXME: consider disabling for CL=*ONE
                 auto send_request = [&] (bool has_data) {
@@ -5800,6 +5810,37 @@ class speculating_read_executor : public abstract_read_executor {
     }
 };
 
+double storage_proxy::speculative_retry_budget() {
+    auto budget = _db.local().get_config().speculative_retry_budget();
+    if (!(budget >= 0 && budget <= 1)) {
+        // Startup rejects such values, but a live update bypasses that check.
+        static thread_local logger::rate_limit rate_limit{std::chrono::seconds(60)};
+        slogger.log(log_level::error, rate_limit, "Ignoring invalid speculative_retry_budget {}, expected a value in [0, 1], keeping {}",
+                budget, _last_valid_speculative_retry_budget);
+        return _last_valid_speculative_retry_budget;
+    }
+    _last_valid_speculative_retry_budget = budget;
+    return budget;
+}
+
+void storage_proxy::add_speculative_retry_budget() {
+    auto budget = speculative_retry_budget();
+    if (budget > 0) {
+        _speculative_retry_budget = std::min(_speculative_retry_budget + budget, max_accrued_speculative_retries);
+    }
+}
+
+bool storage_proxy::try_consume_speculative_retry_budget() {
+    if (speculative_retry_budget() == 0) {
+        return true;
+    }
+    if (_speculative_retry_budget < 1) {
+        return false;
+    }
+    _speculative_retry_budget -= 1;
+    return true;
+}
+
 result<::shared_ptr<abstract_read_executor>> storage_proxy::get_read_executor(lw_shared_ptr<query::read_command> cmd,
         locator::effective_replication_map_ptr erm,
         schema_ptr schema,
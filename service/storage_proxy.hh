@@ -293,6 +293,16 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
     static constexpr float CONCURRENT_SUBREQUESTS_MARGIN = 0.10;
     // for read repair chance calculation
     std::default_random_engine _urandom;
+    // Speculative read retries this shard may still send, see
+    // try_consume_speculative_retry_budget().
+    double _speculative_retry_budget = 0;
+    // See speculative_retry_budget().
+    double _last_valid_speculative_retry_budget = 0;
+    // Upper bound on _speculative_retry_budget. A burst of speculation, e.g.
+    // when a replica stalls, may use retries accrued earlier, but a long quiet
+    // period must not build up an allowance which would let the whole burst
+    // through unlimited.
+    static constexpr double max_accrued_speculative_retries = 100;
     seastar::metrics::metric_groups _metrics;
     uint64_t _background_write_throttle_threahsold;
     inheriting_concrete_execution_stage<
@@ -754,6 +764,15 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
     future<db::hints::sync_point> create_hint_sync_point(std::vector<locator::host_id> target_hosts) const;
     future<> wait_for_hint_sync_point(const db::hints::sync_point spoint, clock_type::time_point deadline);
 
+    // Called for every read which may speculate. Accrues speculative_retry_budget
+    // retries, so that speculative retries are limited to that fraction of reads.
+    void add_speculative_retry_budget();
+    // The configured speculative_retry_budget. If a live update set it out of
+    // [0, 1], the last valid value is kept.
+    double speculative_retry_budget();
+    // Returns true if a speculative read retry may be sent now.
+    bool try_consume_speculative_retry_budget();
+
     const stats& get_stats() const {
         return scheduling_group_get_specific<storage_proxy_stats::stats>(_stats_key);
     }
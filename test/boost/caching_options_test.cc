@@ -24,6 +24,19 @@ BOOST_AUTO_TEST_CASE(test_caching_options) {
         caching_options co = caching_options::from_sstring(in_str);
         sstring out_str = co.to_sstring();
         BOOST_REQUIRE_EQUAL(in_str, out_str);
+        BOOST_REQUIRE(!co.max_rows_populated_per_read());
+    }
+    {
+        string_map in_map = { {"keys", "ALL"}, {"max_rows_populated_per_read", "10"}, {"rows_per_partition", "ALL"}};
+        caching_options co = caching_options::from_map(in_map);
+        BOOST_REQUIRE(co.max_rows_populated_per_read() == 10);
+        BOOST_REQUIRE(in_map == co.to_map());
+    }
+    {
+        BOOST_REQUIRE_THROW(caching_options::from_map({{"max_rows_populated_per_read", "0"}}), std::exception);
+        BOOST_REQUIRE_THROW(caching_options::from_map({{"max_rows_populated_per_read", "-1"}}), std::exception);
+        BOOST_REQUIRE_THROW(caching_options::from_map({{"max_rows_populated_per_read", "-10"}}), std::exception);
+        BOOST_REQUIRE_THROW(caching_options::from_map({{"max_rows_populated_per_read", "ALL"}}), std::exception);
     }
     {
         sstring in_str = "{\"keys\": \"SOME\", \"rows_per_partition\": \"ALL\"}";
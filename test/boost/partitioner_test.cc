@@ -124,6 +124,26 @@ SEASTAR_THREAD_TEST_CASE(test_decorated_key_is_compatible_with_origin) {
     BOOST_REQUIRE(dk._key.equal(*s, key));
 }
 
+// get_token() hashes a contiguous single-component key in place, check that
+// it agrees with hashing the legacy form, up to the largest legal key.
+SEASTAR_THREAD_TEST_CASE(test_single_component_key_token_matches_legacy_form) {
+    auto s = schema_builder("ks", "cf")
+        .with_column("pk", bytes_type, column_kind::partition_key)
+        .with_column("v", int32_type)
+        .build();
+
+    dht::murmur3_partitioner partitioner;
+    // A singular key is serialized with a 2-byte length prefix, and the
+    // whole key is limited to 65535 bytes.
+    for (size_t size : {0, 1, 15, 16, 17, 100, 1000, 65533}) {
+        auto key = partition_key::from_single_value(*s, tests::random::get_bytes(size));
+        auto legacy = key.legacy_form(*s);
+        bytes legacy_bytes(bytes::initialized_later(), legacy.size());
+        std::copy(legacy.begin(), legacy.end(), legacy_bytes.begin());
+        BOOST_REQUIRE_EQUAL(partitioner.get_token(*s, key), partitioner.get_token(bytes_view(legacy_bytes)));
+    }
+}
+
 SEASTAR_THREAD_TEST_CASE(test_token_wraparound_1) {
     auto t1 = token_from_long(0x7000'0000'0000'0000);
     auto t2 = token_from_long(0xa000'0000'0000'0000);
@@ -3956,6 +3956,44 @@ SEASTAR_TEST_CASE(test_scans_erase_dummies) {
     });
 }
 
+SEASTAR_TEST_CASE(test_max_rows_populated_per_read) {
+    return seastar::async([] {
+        simple_schema base;
+        auto limited = schema_builder(base.schema())
+                .set_caching_options(caching_options::from_map({{caching_options::max_rows_populated_per_read_key, "2"}}))
+                .build();
+        simple_schema s(limited, api::new_timestamp());
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+        auto cache_mt = make_lw_shared<replica::memtable>(s.schema());
+
+        auto pkey = s.make_pkey("pk");
+        mutation m1(s.schema(), pkey);
+        for (int i = 0; i < 10; ++i) {
+            s.add_row(m1, s.make_ckey(i), "v1");
+        }
+        cache_mt->apply(m1);
+
+        cache_tracker tracker;
+        row_cache cache(s.schema(), snapshot_source_from_snapshot(cache_mt->as_data_source()), tracker);
+
+        auto pr = dht::partition_range::make_singular(pkey);
+
+        // Expect the first 2 rows and the last dummy.
+        assert_that(cache.make_reader(s.schema(), semaphore.make_permit(), pr))
+            .produces(m1)
+            .produces_end_of_stream();
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().rows, 3);
+        BOOST_REQUIRE_GT(tracker.get_stats().populations_over_limit, 0);
+
+        // The next read is served from cache for the first 2 rows, then
+        // populates the next 2 from underlying.
+        assert_that(cache.make_reader(s.schema(), semaphore.make_permit(), pr))
+            .produces(m1)
+            .produces_end_of_stream();
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().rows, 5);
+    });
+}
+
 SEASTAR_TEST_CASE(test_range_tombstone_adjacent_with_population_bound) {
     return seastar::async([] {
         simple_schema s;
@@ -259,3 +259,40 @@ async def test_vnode_keyspace_describe_ring(manager: ManagerClient):
         for i in range(1, len(sorted_tokens)):
             assert end_tokens[sorted_tokens[i-1]] == sorted_tokens[i]
         assert end_tokens[sorted_tokens[-1]] == sorted_tokens[0]
+
+@pytest.mark.asyncio
+async def test_repair_skips_row_hashes_of_empty_follower(manager):
+    """
+    Check that when a repair follower holds no rows at all in a repair round's
+    range, the master doesn't ask it for its (empty) full row hashes, and still
+    sends it all of its rows.
+    """
+    cfg = { 'tablets_mode_for_new_keyspaces': 'disabled' }
+    cmdline = ["--hinted-handoff-enabled", "0", "--logger-log-level", "repair=debug"]
+    node1, node2 = await manager.servers_add(2, cmdline=cmdline, config=cfg, auto_rack_dc="dc1")
+
+    cql = manager.get_cql()
+
+    cql.execute("CREATE KEYSPACE ks WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 2}")
+    cql.execute("CREATE TABLE ks.tbl (pk int PRIMARY KEY, v int)")
+
+    # node2 misses all the writes, so it has no rows in any repair round.
+    await manager.server_stop_gracefully(node2.server_id)
+    stmt = cql.prepare("INSERT INTO ks.tbl (pk, v) VALUES (?, ?)")
+    stmt.consistency_level = ConsistencyLevel.ONE
+    for pk in range(100):
+        cql.execute(stmt, [pk, pk])
+    await manager.server_start(node2.server_id, wait_others=1)
+
+    log = await manager.server_open_log(node1.server_id)
+    mark = await log.mark()
+
+    await manager.api.repair(node1.ip_addr, "ks", "tbl")
+
+    assert len(await log.grep("FastPath: node .* has no rows, skip get_full_row_hashes", from_mark=mark)) > 0
+    assert len(await log.grep("Before master.get_full_row_hashes for node", from_mark=mark)) == 0
+
+    _, host2 = await wait_for_cql_and_get_hosts(cql, [node1, node2], time.time() + 30)
+    for pk in (0, 42, 99):
+        res = cql.execute(f"SELECT * FROM MUTATION_FRAGMENTS(ks.tbl) WHERE pk = {pk}", host=host2)
+        assert [r.mutation_fragment_kind for r in res].count('clustering row') == 1
@@ -0,0 +1,99 @@
+# Copyright (C) 2026-present ScyllaDB
+#
+# SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+from cassandra import ConsistencyLevel
+from cassandra.query import SimpleStatement
+from test.cluster.conftest import skip_mode
+from test.cluster.util import new_test_keyspace
+from test.pylib.manager_client import ManagerClient
+from test.pylib.rest_client import inject_error
+
+import asyncio
+import pytest
+import logging
+import time
+
+logger = logging.getLogger(__name__)
+
+
+@skip_mode('release', 'error injections are not supported in release mode')
+@pytest.mark.asyncio
+async def test_speculative_retry_budget(manager: ManagerClient):
+    """
+    Reads which may speculate accrue speculative_retry_budget retries each, and
+    a speculative retry consumes a whole one. With a budget of 0.5 the first
+    read cannot speculate and is counted in speculative_reads_over_budget,
+    while the second one has accrued a full retry and speculates.
+
+    Reads are blocked on the two remote replicas, so that every read at QUORUM
+    waits for the speculation timer. The coordinator runs with a single shard,
+    because the budget is kept per shard.
+    """
+    cmdline = ['--smp', '1']
+    config = {
+        'speculative_retry_budget': 0.5,
+        # Keep the coordinator's own replica first among the targets, so
+        # every read is served by it and exactly one remote replica.
+        'cache_hit_rate_read_balancing': False,
+    }
+    servers = await manager.servers_add(3, cmdline=cmdline, config=config, auto_rack_dc="dc1")
+    coordinator, others = servers[0], servers[1:]
+    cql = await manager.get_cql_exclusive(coordinator)
+
+    async def get_metric(name):
+        metrics = await manager.metrics.query(coordinator.ip_addr)
+        return metrics.get(f"scylla_storage_proxy_coordinator_{name}") or 0
+
+    async def over_budget():
+        return await get_metric("speculative_reads_over_budget")
+
+    async def speculated():
+        return await get_metric("speculative_digest_reads") + await get_metric("speculative_data_reads")
+
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 3}") as ks:
+        await cql.run_async(f"CREATE TABLE {ks}.tbl (pk int PRIMARY KEY, v int) WITH speculative_retry = '10ms'")
+        await cql.run_async(SimpleStatement(f"INSERT INTO {ks}.tbl (pk, v) VALUES (0, 0)", consistency_level=ConsistencyLevel.ALL))
+        logs = [await manager.server_open_log(s.server_id) for s in others]
+
+        # Reads once and returns by how much the counter changed.
+        async def read(counter, expected_blocked_reads):
+            marks = [await log.mark() for log in logs]
+            before = await counter()
+            query = SimpleStatement(f"SELECT v FROM {ks}.tbl WHERE pk = 0", consistency_level=ConsistencyLevel.QUORUM)
+            query_future = cql.run_async(query)
+
+            deadline = time.time() + 60
+            while await counter() == before:
+                assert time.time() < deadline, f"{counter.__name__} did not change"
+                await asyncio.sleep(0.1)
+
+            # Each blocked read waits for its own message; unblock exactly
+            # the reads which reached the remote replicas.
+            while True:
+                hits = [len(await log.grep("storage_proxy::handle_read injection hit", from_mark=mark))
+                        for log, mark in zip(logs, marks)]
+                if sum(hits) == expected_blocked_reads:
+                    break
+                assert time.time() < deadline, f"expected {expected_blocked_reads} blocked reads, got {hits}"
+                await asyncio.sleep(0.1)
+            for handler, n in zip(handlers, hits):
+                for _ in range(n):
+                    await handler.message()
+
+            assert [row.v for row in await query_future] == [0]
+            return await counter() - before
+
+        async with inject_error(manager.api, others[0].ip_addr, 'storage_proxy::handle_read', parameters={'cf_name': 'tbl'}) as h1, \
+                   inject_error(manager.api, others[1].ip_addr, 'storage_proxy::handle_read', parameters={'cf_name': 'tbl'}) as h2:
+            handlers = [h1, h2]
+
+            logger.info("First read accrues half a retry and may not speculate")
+            assert await read(over_budget, 1) == 1
+
+            logger.info("Second read completes a retry and speculates")
+            assert await read(speculated, 2) == 1
+            assert await over_budget() == 1
+
+            logger.info("The retry was consumed, so the third read may not speculate")
+            assert await read(over_budget, 1) == 1
+            assert await over_budget() == 2
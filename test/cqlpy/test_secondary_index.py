@@ -15,7 +15,7 @@ from cassandra.protocol import SyntaxException, AlreadyExists, InvalidRequest, C
 from cassandra.query import SimpleStatement
 from .cassandra_tests.porting import assert_rows, assert_row_count, assert_rows_ignoring_order, assert_empty
 
-from .util import new_test_table, unique_name, unique_key_int, is_scylla
+from .util import new_test_table, unique_name, unique_key_int, is_scylla, ScyllaMetrics
 
 # A reproducer for issue #7443: Normally, when the entire table is SELECTed,
 # the partitions are returned sorted by the partitions' token. When there
@@ -2100,3 +2100,81 @@ def test_limit_partition_slice(cql, test_keyspace):
         rs = cql.execute(f'SELECT pk, ck2 FROM {table} WHERE ck1 = 1 LIMIT 3')
         assert sorted(list(rs)) == [(1,1), (1,2), (2,1)]
         assert rs.has_more_pages == False
+
+# A query which selects only base primary key columns can be answered from
+# the index alone, without reading the matching rows from the base table,
+# if the index is updated synchronously (see the test below). Check that such
+# queries return the same rows, in the same order, as queries which do need
+# the base table, with and without paging and with LIMIT. The
+# synchronous_updates property is a Scylla extension.
+def test_select_only_primary_key_with_index(cql, test_keyspace, scylla_only):
+    def index_only_reads():
+        return ScyllaMetrics.query(cql).get('scylla_cql_secondary_index_index_only_reads') or 0
+    with new_test_table(cql, test_keyspace, 'pk int, ck int, v int, w int, primary key (pk, ck)') as table:
+        index_name = unique_name()
+        cql.execute(f'CREATE INDEX {index_name} ON {table}(v)')
+        cql.execute(f'ALTER MATERIALIZED VIEW {test_keyspace}.{index_name}_index WITH synchronous_updates = true')
+        stmt = cql.prepare(f'INSERT INTO {table} (pk, ck, v, w) VALUES (?, ?, ?, ?)')
+        for pk in range(5):
+            for ck in range(4):
+                cql.execute(stmt, [pk, ck, ck % 2, pk * ck])
+        cql.execute(f'DELETE FROM {table} WHERE pk = 3 AND ck = 1')
+        expected = [(row.pk, row.ck) for row in cql.execute(f'SELECT pk, ck, w FROM {table} WHERE v = 1')]
+        assert len(expected) == 9
+        for page_size in [1, 2, 3, 100]:
+            # Every page is a separate index-only read.
+            pages = (len(expected) + page_size - 1) // page_size
+            before = index_only_reads()
+            s = SimpleStatement(f'SELECT ck, pk FROM {table} WHERE v = 1', fetch_size=page_size)
+            assert [(row.pk, row.ck) for row in cql.execute(s)] == expected
+            assert index_only_reads() - before >= pages
+            before = index_only_reads()
+            s = SimpleStatement(f'SELECT pk FROM {table} WHERE v = 1', fetch_size=page_size)
+            assert [row.pk for row in cql.execute(s)] == [pk for pk, _ in expected]
+            assert index_only_reads() - before >= pages
+        before = index_only_reads()
+        assert [(row.pk, row.ck) for row in cql.execute(f'SELECT pk, ck FROM {table} WHERE v = 1 LIMIT 4')] == expected[:4]
+        assert index_only_reads() - before >= 1
+
+# Answering from the index alone is only allowed for indexes whose view is
+# updated synchronously - local indexes, or global ones with the
+# synchronous_updates property. An asynchronous index may still hold rows
+# whose base row was already deleted, and only the base read filters them out.
+# Check, using tracing, which queries take the index-only path, including a
+# table without clustering key, whose queries otherwise read whole partitions.
+# The synchronous_updates property is a Scylla extension.
+def test_select_only_primary_key_index_only_path(cql, test_keyspace, scylla_only):
+    def index_only(query):
+        trace = cql.execute(query, trace=True).get_query_trace()
+        return any('answering from the index alone' in event.description for event in trace.events)
+    with new_test_table(cql, test_keyspace, 'pk int, ck int, v int, primary key (pk, ck)') as table:
+        index_name = unique_name()
+        cql.execute(f'CREATE INDEX {index_name} ON {table}(v)')
+        cql.execute(f'CREATE INDEX ON {table}((pk), v)')
+        for pk in range(3):
+            for ck in range(3):
+                cql.execute(f'INSERT INTO {table} (pk, ck, v) VALUES ({pk}, {ck}, {ck % 2})')
+        expected = [(row.pk, row.ck) for row in cql.execute(f'SELECT pk, ck, v FROM {table} WHERE v = 0')]
+        # A global index is updated asynchronously by default.
+        assert not index_only(f'SELECT pk, ck FROM {table} WHERE v = 0')
+        assert [(row.pk, row.ck) for row in cql.execute(f'SELECT pk, ck FROM {table} WHERE v = 0')] == expected
+        # A local index is always updated synchronously.
+        assert index_only(f'SELECT pk, ck FROM {table} WHERE pk = 1 AND v = 0')
+        assert list(cql.execute(f'SELECT pk, ck FROM {table} WHERE pk = 1 AND v = 0')) == [(1, 0), (1, 2)]
+        # A global index made synchronous.
+        cql.execute(f'ALTER MATERIALIZED VIEW {test_keyspace}.{index_name}_index WITH synchronous_updates = true')
+        assert index_only(f'SELECT pk, ck FROM {table} WHERE v = 0')
+        assert [(row.pk, row.ck) for row in cql.execute(f'SELECT pk, ck FROM {table} WHERE v = 0')] == expected
+    with new_test_table(cql, test_keyspace, 'p int primary key, v int') as table:
+        index_name = unique_name()
+        cql.execute(f'CREATE INDEX {index_name} ON {table}(v)')
+        cql.execute(f'ALTER MATERIALIZED VIEW {test_keyspace}.{index_name}_index WITH synchronous_updates = true')
+        for p in range(10):
+            cql.execute(f'INSERT INTO {table} (p, v) VALUES ({p}, {p % 2})')
+        cql.execute(f'DELETE FROM {table} WHERE p = 3')
+        expected = [row.p for row in cql.execute(f'SELECT p, v FROM {table} WHERE v = 1')]
+        assert sorted(expected) == [1, 5, 7, 9]
+        assert index_only(f'SELECT p FROM {table} WHERE v = 1')
+        for page_size in [1, 3, 100]:
+            s = SimpleStatement(f'SELECT p FROM {table} WHERE v = 1', fetch_size=page_size)
+            assert [row.p for row in cql.execute(s)] == expected
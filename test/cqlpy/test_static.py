@@ -10,8 +10,9 @@
 #############################################################################
 
 import pytest
+from cassandra.query import SimpleStatement
 
-from .util import new_test_table, unique_key_int
+from .util import new_test_table, unique_key_int, random_string
 
 @pytest.fixture(scope="module")
 def table1(cql, test_keyspace):
@@ -95,3 +96,25 @@ def test_filter_with_only_static(cql, table1):
     # for r=4 should return nothing. But issue #10357 caused Scylla to wrongly
     # return a row with only the static value - which doesn't match the filter.
     assert list(cql.execute(f'SELECT p, s, c, r FROM {table1} WHERE p={p} AND r=4 ALLOW FILTERING')) == []
+
+# Selected partition key columns are returned in every row of the partition,
+# and in the single row of a partition which only has static columns. Use
+# keys longer than 15 bytes, which are not stored inline, so that a row
+# reading a key after it was freed would return garbage (or crash under ASAN).
+def test_select_long_partition_key_columns(cql, test_keyspace):
+    schema = 'p1 text, p2 text, c int, s int static, PRIMARY KEY ((p1, p2), c)'
+    with new_test_table(cql, test_keyspace, schema) as table:
+        expected = set()
+        for i in range(3):
+            p1, p2 = random_string(40), random_string(100)
+            cql.execute(f"INSERT INTO {table} (p1, p2, s) VALUES ('{p1}', '{p2}', {i})")
+            for c in range(5):
+                cql.execute(f"INSERT INTO {table} (p1, p2, c) VALUES ('{p1}', '{p2}', {c})")
+                expected.add((p1, p2, c, i))
+        p1, p2 = random_string(40), random_string(100)
+        cql.execute(f"INSERT INTO {table} (p1, p2, s) VALUES ('{p1}', '{p2}', 7)")
+        expected.add((p1, p2, None, 7))
+        assert set(cql.execute(f'SELECT p1, p2, c, s FROM {table}')) == expected
+        # Also with paging, so that partitions are split across pages.
+        stmt = SimpleStatement(f'SELECT p1, p2, c, s FROM {table}', fetch_size=2)
+        assert set(cql.execute(stmt)) == expected
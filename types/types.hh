@@ -574,23 +574,26 @@ bool operator==(const data_value& x, const data_value& y);
 using bytes_view_opt = std::optional<bytes_view>;
 using managed_bytes_view_opt = std::optional<managed_bytes_view>;
 
+// The type is taken by reference: these are called per key component from
+// the clustering key comparators, where copying the data_type would add a
+// reference count update to every comparison.
 inline
-std::strong_ordering tri_compare(data_type t, managed_bytes_view e1, managed_bytes_view e2) {
+std::strong_ordering tri_compare(const data_type& t, managed_bytes_view e1, managed_bytes_view e2) {
     return t->compare(e1, e2);
 }
 
 inline
 std::strong_ordering
-tri_compare_opt(data_type t, managed_bytes_view_opt v1, managed_bytes_view_opt v2) {
+tri_compare_opt(const data_type& t, managed_bytes_view_opt v1, managed_bytes_view_opt v2) {
     if (!v1 || !v2) {
         return bool(v1) <=> bool(v2);
     } else {
-        return tri_compare(std::move(t), *v1, *v2);
+        return tri_compare(t, *v1, *v2);
     }
 }
 
 inline
-bool equal(data_type t, managed_bytes_view e1, managed_bytes_view e2) {
+bool equal(const data_type& t, managed_bytes_view e1, managed_bytes_view e2) {
     return t->equal(e1, e2);
 }
 
@@ -482,6 +482,10 @@ class tracker::impl {
     bool _abort_on_bad_alloc = false;
     bool _sanitizer_report_backtrace = false;
     reclaim_timer* _active_timer = nullptr;
+    // Synchronous (allocation-time) and background reclaim, as measured by reclaim_timer.
+    uint64_t _reclaims = 0;
+    uint64_t _reclaim_stalls = 0;
+    std::chrono::microseconds _reclaim_time{0};
 private:
     // Prevents tracker's reclaimer from running while live. Reclaimer may be
     // invoked synchronously with allocator. This guard ensures that this
@@ -556,6 +560,11 @@ class tracker::impl {
         _active_timer = &timer;
         return true;
     }
+    void on_reclaim_timer_done(std::chrono::microseconds duration, bool stall_detected) noexcept {
+        ++_reclaims;
+        _reclaim_stalls += stall_detected;
+        _reclaim_time += duration;
+    }
     bool try_reset_active_timer(reclaim_timer& timer) {
         if (_active_timer == &timer) {
             _active_timer = nullptr;
@@ -1523,6 +1532,7 @@ reclaim_timer::~reclaim_timer() {
 
     _duration = clock::now() - _start;
     _stall_detected = _duration >= _duration_threshold;
+    _tracker.on_reclaim_timer_done(std::chrono::duration_cast<std::chrono::microseconds>(_duration), _stall_detected);
     if (_debug_enabled || _stall_detected) {
         sample_stats(_end_stats);
         _stat_diff = _end_stats - _start_stats;
@@ -2853,6 +2863,15 @@ tracker::impl::impl() : _segment_pool(std::make_unique<logalloc::segment_pool>(*
 
         sm::make_counter("memory_freed", [this] { return _segment_pool->statistics().memory_freed; },
                         sm::description("Counts number of bytes which were requested to be freed in LSA.")),
+
+        sm::make_counter("reclaims", [this] { return _reclaims; },
+                        sm::description("Counts number of timed LSA reclaim operations (compaction and eviction).")),
+
+        sm::make_counter("reclaim_stalls", [this] { return _reclaim_stalls; },
+                        sm::description("Counts number of LSA reclaim operations which took longer than the reactor stall threshold.")),
+
+        sm::make_counter("reclaim_time_us", [this] { return _reclaim_time.count(); },
+                        sm::description("Counts total time in microseconds spent in timed LSA reclaim operations.")),
     });
 }
 